@@ -1,7 +1,11 @@
+// Expose clock_gettime() and CLOCK_MONOTONIC when compiling in strict ISO C mode
+#define _POSIX_C_SOURCE 199309L
+
 #include <stdio.h>
 #include <stdbool.h>
 #include <string.h>
 #include <stdlib.h>
+#include <time.h>
 
 // When building a native Windows executable with MinGW,
 // initialize console to UTF-8 to allow unicode characters
@@ -11,6 +15,22 @@
     void init_console(void) {
         SetConsoleOutputCP(CP_UTF8);
     }
+    // Function to read the monotonic performance counter in microseconds in MinGW
+    long long getMonotonicTimeUs(void) {
+        LARGE_INTEGER frequency;
+        LARGE_INTEGER counter;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&counter);
+        return (counter.QuadPart / frequency.QuadPart) * 1000000LL
+            + (counter.QuadPart % frequency.QuadPart) * 1000000LL / frequency.QuadPart;
+    }
+#else
+    // Function to read the POSIX monotonic clock in microseconds
+    long long getMonotonicTimeUs(void) {
+        struct timespec now;
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        return (long long) now.tv_sec * 1000000LL + now.tv_nsec / 1000;
+    }
 #endif
 
 // Some hardcoded constants
@@ -19,9 +39,41 @@
 #define BLANC_FIELD_VALUE ' '
 #define MAX_ROWS 30
 #define MAX_COLUMNS 50
+#define MAX_TOTAL_TIME_SECONDS 3600
+#define MAX_INCREMENT_SECONDS 60
+#define MAX_MOVE_TIME_SECONDS 600
+
+// CPU player constants
+#define CPU_DEFAULT_MOVE_TIME_US 1000000LL
+#define CPU_MIN_SAFETY_MARGIN_US 5000LL
+#define CPU_SAFETY_MARGIN_DIVISOR 20
+#define CPU_MOVES_TO_GO_HORIZON 30
+#define CPU_MAX_SEARCH_DEPTH 24
+#define CPU_CLOCK_CHECK_MASK 63
+#define CPU_WIN_SCORE 100000000
 
 // enums
 enum yesOrNo { YES, NO };
+enum timeControlType { NO_TIME_CONTROL, TOTAL_PLUS_INCREMENT, FIXED_PER_MOVE };
+
+// structs
+struct timeControl {
+    enum timeControlType type;
+    long long totalTimeUs;
+    long long incrementUs;
+    long long moveTimeUs;
+};
+struct moveTiming {
+    int playerNbr;
+    int fieldNbr;
+    long long budgetUs;
+    long long actualUs;
+};
+struct cpuSearch {
+    long long deadlineUs;
+    long nodeCount;
+    bool isAborted;
+};
 
 // function prototypes
 int requestGameProperties(void);
@@ -44,12 +96,29 @@ int printScores(bool isPlayer1X, int player1Score, int player2Score, int rowWidt
 int drawBoard(void);
 int calcFieldWidth(void);
 int calcNumberWidth(int number);
+void initializeClocks(long long *player1ClockUs, long long *player2ClockUs);
+long long calcTurnAllottedUs(long long playerClockUs);
+void updatePlayerClock(long long *playerClockUs, long long turnElapsedUs);
+void printTurnTime(int playerNbr, long long turnAllottedUs);
+void recordMoveTiming(int moveIdx, int playerNbr, int fieldNbr, long long budgetUs, long long actualUs);
+void printMoveTimings(int moveCount);
+long long calcCpuMoveBudgetUs(long long turnAllottedUs);
+int requestCpuMove(char mark, long long turnStartUs, long long budgetUs);
+int scoreCpuMove(int fieldNbr, int depth, int ply, int alpha, int beta, char mark, struct cpuSearch *search);
+int searchCpuMoves(int depth, int ply, int alpha, int beta, char mark, struct cpuSearch *search);
+int getCandidateFields(int *candidates);
+int evaluateBoard(char mark);
+int countBlancFields(void);
+bool isInsideBoard(int rowIdx, int columnIdx);
 
 // Global pointers to dynamically allocated memory
 int *ROWS = NULL;
 int *COLUMNS = NULL;
 int *N_IN_A_ROW = NULL;
+bool *IS_PLAYER2_CPU = NULL;
+struct timeControl *TIME_CONTROL = NULL;
 char **BOARD = NULL;
+struct moveTiming *MOVE_TIMINGS = NULL;
 
 /*
  * main function with main game loop
@@ -78,8 +147,17 @@ int main(int argc, char **argv) {
     bool isGameWon = false;
     bool isEscExitGame = false;
 
+    // Set time control variables
+    long long player1ClockUs = 0;
+    long long player2ClockUs = 0;
+    long long turnStartUs = -1;
+    long long turnAllottedUs = 0;
+    long long turnBudgetUs = 0;
+    int moveCount = 0;
+
     // Initialize game
     initializeBoard();
+    initializeClocks(&player1ClockUs, &player2ClockUs);
     returnCode = refreshScreen(isPlayer1X, player1Score, player2Score);
     if (returnCode != 0) {
         freeDynamicMemory();
@@ -88,40 +166,73 @@ int main(int argc, char **argv) {
     
     // Main game loop
     do {
-        // Request current player's next mark by field number
+        // Determine current player and mark
+        int playerNbr;
         char mark;
         if (isPlayer1X) {
             if (isPlayer1Turn) {
-                fieldNbr = requestPlayerInput(1);
+                playerNbr = 1;
                 mark = 'X';
             } else {
-                fieldNbr = requestPlayerInput(2);
+                playerNbr = 2;
                 mark = 'O';
             }
         } else {
             if (isPlayer1Turn) {
-                fieldNbr = requestPlayerInput(1);
+                playerNbr = 1;
                 mark = 'O';
             } else {
-                fieldNbr = requestPlayerInput(2);
+                playerNbr = 2;
                 mark = 'X';
             }
         }
-        // Mark the board at the given field number with the current player's mark
-        bool validMark = markBoard(fieldNbr, mark);
-        // If the mark is invalid, just repeat the question
-        if (!validMark) {
-            continue;
+        long long *playerClockUs = isPlayer1Turn ? &player1ClockUs : &player2ClockUs;
+        // Start the turn clock, unless the question is being repeated after an invalid mark
+        if (turnStartUs < 0) {
+            turnStartUs = getMonotonicTimeUs();
+            turnAllottedUs = calcTurnAllottedUs(*playerClockUs);
+            printTurnTime(playerNbr, turnAllottedUs);
         }
+        // Request current player's next mark by field number
+        if (!isPlayer1Turn && *IS_PLAYER2_CPU) {
+            turnBudgetUs = calcCpuMoveBudgetUs(turnAllottedUs);
+            fieldNbr = requestCpuMove(mark, turnStartUs, turnBudgetUs);
+        } else {
+            turnBudgetUs = turnAllottedUs;
+            fieldNbr = requestPlayerInput(playerNbr);
+        }
+        // A move made after the allotted time has run out does not count
+        long long turnElapsedUs = getMonotonicTimeUs() - turnStartUs;
+        bool isTimeForfeit = turnAllottedUs > 0 && turnElapsedUs > turnAllottedUs;
+        if (!isTimeForfeit) {
+            // Mark the board at the given field number with the current player's mark
+            bool validMark = markBoard(fieldNbr, mark);
+            // If the mark is invalid, just repeat the question
+            if (!validMark) {
+                continue;
+            }
+        }
+        // Record actual vs. budgeted time for this move and settle the player's clock
+        recordMoveTiming(moveCount++, playerNbr, isTimeForfeit ? 0 : fieldNbr, turnBudgetUs, turnElapsedUs);
+        updatePlayerClock(playerClockUs, turnElapsedUs);
+        turnStartUs = -1;
         // Refresh the screen to show the new mark
         returnCode = refreshScreen(isPlayer1X, player1Score, player2Score);
         if (returnCode != 0) break;
-        // Check if current player has won
-        isGameWon = chkWinCondition(fieldNbr, mark);
+        if (isTimeForfeit) {
+            // Running out of time makes the opponent win
+            printf("=> Player%d ran out of time!\n", playerNbr);
+            isPlayer1Turn = !isPlayer1Turn;
+            isGameWon = true;
+        } else {
+            // Check if current player has won
+            isGameWon = chkWinCondition(fieldNbr, mark);
+        }
         // If current player wins, propose optional rematch
         if (isGameWon) {
             // Say who wins
             isPlayer1Turn ? printf("=> Player1 wins!\n\n") : printf("=> Player2 wins!\n\n");
+            printMoveTimings(moveCount);
             // Pose rematch game question
             enum yesOrNo answer = yesOrNoQuestion("Do you want a rematch?", YES);
             // Check the answer for the rematch question
@@ -136,6 +247,8 @@ int main(int argc, char **argv) {
                     isPlayer1Turn = isPlayer1X;
                     // Initialize game again
                     initializeBoard();
+                    initializeClocks(&player1ClockUs, &player2ClockUs);
+                    moveCount = 0;
                     returnCode = refreshScreen(isPlayer1X, player1Score, player2Score);
                     break;
                 // When game is to be exited
@@ -148,6 +261,7 @@ int main(int argc, char **argv) {
             if (returnCode != 0) break;
         } else if(chkForDraw()) {
             printf("=> It's a draw!\n\n");
+            printMoveTimings(moveCount);
             enum yesOrNo answer = yesOrNoQuestion("Do you want to continue playing?", YES);
             // Check the answer for the continue question
             switch (answer) {
@@ -159,6 +273,8 @@ int main(int argc, char **argv) {
                     isPlayer1Turn = isPlayer1X;
                     // Initialize game again
                     initializeBoard();
+                    initializeClocks(&player1ClockUs, &player2ClockUs);
+                    moveCount = 0;
                     returnCode = refreshScreen(isPlayer1X, player1Score, player2Score);
                     break;
                 // When game is to be exited
@@ -203,10 +319,44 @@ int requestGameProperties(void) {
         free(COLUMNS);
         return 1;
     }
+    IS_PLAYER2_CPU = (bool *) malloc(sizeof(bool));
+    if (IS_PLAYER2_CPU == NULL) {
+        printf("=> Memory allocation for CPU opponent setting failed!\n");
+        free(ROWS);
+        free(COLUMNS);
+        free(N_IN_A_ROW);
+        return 1;
+    }
+    TIME_CONTROL = (struct timeControl *) malloc(sizeof(struct timeControl));
+    if (TIME_CONTROL == NULL) {
+        printf("=> Memory allocation for time control failed!\n");
+        free(ROWS);
+        free(COLUMNS);
+        free(N_IN_A_ROW);
+        free(IS_PLAYER2_CPU);
+        return 1;
+    }
     enum yesOrNo answer = yesOrNoQuestion("Do you want to play default TicTacToe?", YES);
     *ROWS = answer == YES ? 3 : requestIntInRange("Enter number of rows for board/grid", 3, MAX_ROWS);
     *COLUMNS = answer == YES ? 3 : requestIntInRange("Enter number of columns for board/grid", 3, MAX_COLUMNS);
     *N_IN_A_ROW = answer == YES ? 3 : requestIntInRange("Enter number of consecutive marks needed for a win", 3, *ROWS < *COLUMNS ? *ROWS : *COLUMNS);
+    *IS_PLAYER2_CPU = yesOrNoQuestion("Do you want Player2 to be a CPU opponent?", NO) == YES;
+    TIME_CONTROL->type = NO_TIME_CONTROL;
+    TIME_CONTROL->totalTimeUs = 0;
+    TIME_CONTROL->incrementUs = 0;
+    TIME_CONTROL->moveTimeUs = 0;
+    answer = yesOrNoQuestion("Do you want to play with a time control?", NO);
+    if (answer == YES) {
+        int type = requestIntInRange("Enter time control (1 = total time plus increment, 2 = fixed time per move)", 1, 2);
+        if (type == 1) {
+            TIME_CONTROL->type = TOTAL_PLUS_INCREMENT;
+            TIME_CONTROL->totalTimeUs = requestIntInRange("Enter total time per player in seconds", 1, MAX_TOTAL_TIME_SECONDS) * 1000000LL;
+            TIME_CONTROL->incrementUs = requestIntInRange("Enter increment per move in seconds", 0, MAX_INCREMENT_SECONDS) * 1000000LL;
+        } else {
+            TIME_CONTROL->type = FIXED_PER_MOVE;
+            TIME_CONTROL->moveTimeUs = requestIntInRange("Enter time per move in seconds", 1, MAX_MOVE_TIME_SECONDS) * 1000000LL;
+        }
+    }
     return 0;
 }
 
@@ -230,10 +380,20 @@ int allocateBoardMemory(void) {
             }
         }
     }
+    if (returnValue == 0) {
+        // Each move of a game is timed, so a game never has more timings than fields
+        MOVE_TIMINGS = (struct moveTiming *) malloc(*ROWS * *COLUMNS * sizeof(struct moveTiming));
+        if (MOVE_TIMINGS == NULL) {
+            printf("=> Memory allocation for move timings failed!\n");
+            returnValue = 1;
+        }
+    }
     if (returnValue != 0) {
         free(ROWS);
         free(COLUMNS);
         free(N_IN_A_ROW);
+        free(IS_PLAYER2_CPU);
+        free(TIME_CONTROL);
     }
     return returnValue;
 }
@@ -246,9 +406,12 @@ void freeDynamicMemory(void) {
         free(BOARD[i]);
     }
     free(BOARD);
+    free(MOVE_TIMINGS);
     free(ROWS);
     free(COLUMNS);
     free(N_IN_A_ROW);
+    free(IS_PLAYER2_CPU);
+    free(TIME_CONTROL);
 }
 
 /*
@@ -671,4 +834,317 @@ int calcNumberWidth(int number) {
         numberWidth = 4;
     }
     return numberWidth;
-}
\ No newline at end of file
+}
+/*
+ * Initialize the clocks of both players at the start of a game
+ */
+void initializeClocks(long long *player1ClockUs, long long *player2ClockUs) {
+    *player1ClockUs = TIME_CONTROL->totalTimeUs;
+    *player2ClockUs = TIME_CONTROL->totalTimeUs;
+}
+
+/*
+ * Calculate the time a player is allotted for the current turn (0 means unlimited)
+ */
+long long calcTurnAllottedUs(long long playerClockUs) {
+    long long turnAllottedUs = 0;
+    switch (TIME_CONTROL->type) {
+        case TOTAL_PLUS_INCREMENT:
+            turnAllottedUs = playerClockUs;
+            break;
+        case FIXED_PER_MOVE:
+            turnAllottedUs = TIME_CONTROL->moveTimeUs;
+            break;
+        case NO_TIME_CONTROL:
+            break;
+    }
+    return turnAllottedUs;
+}
+
+/*
+ * Subtract the time spent on a move from the player's clock and add the increment
+ */
+void updatePlayerClock(long long *playerClockUs, long long turnElapsedUs) {
+    if (TIME_CONTROL->type == TOTAL_PLUS_INCREMENT) {
+        *playerClockUs -= turnElapsedUs;
+        *playerClockUs += TIME_CONTROL->incrementUs;
+    }
+}
+
+/*
+ * Print the time the current player has left for this turn
+ */
+void printTurnTime(int playerNbr, long long turnAllottedUs) {
+    if (TIME_CONTROL->type == TOTAL_PLUS_INCREMENT) {
+        printf("Player%d has %.1f s left on the clock\n", playerNbr, turnAllottedUs / 1000000.0);
+    } else if (TIME_CONTROL->type == FIXED_PER_MOVE) {
+        printf("Player%d has %.1f s for this move\n", playerNbr, turnAllottedUs / 1000000.0);
+    }
+}
+
+/*
+ * Record the budgeted and actual time of a move (fieldNbr 0 means the player ran out of time)
+ */
+void recordMoveTiming(int moveIdx, int playerNbr, int fieldNbr, long long budgetUs, long long actualUs) {
+    MOVE_TIMINGS[moveIdx].playerNbr = playerNbr;
+    MOVE_TIMINGS[moveIdx].fieldNbr = fieldNbr;
+    MOVE_TIMINGS[moveIdx].budgetUs = budgetUs;
+    MOVE_TIMINGS[moveIdx].actualUs = actualUs;
+}
+
+/*
+ * Print the budgeted vs. actual time of every move in the last game,
+ * but only when moves are timed or a CPU opponent is playing
+ */
+void printMoveTimings(int moveCount) {
+    if (TIME_CONTROL->type == NO_TIME_CONTROL && !*IS_PLAYER2_CPU) {
+        return;
+    }
+    int overBudgetCount = 0;
+    long long maxActualUs = 0;
+    printf("Move timings:\n");
+    printf("%6s  %-7s  %5s  %12s  %12s\n", "Move", "Player", "Field", "Budget (ms)", "Actual (ms)");
+    for (int i = 0; i < moveCount; i++) {
+        struct moveTiming *timing = &MOVE_TIMINGS[i];
+        printf("%6d  Player%d  ", i + 1, timing->playerNbr);
+        timing->fieldNbr > 0 ? printf("%5d  ", timing->fieldNbr) : printf("%5s  ", "-");
+        timing->budgetUs > 0 ? printf("%12.1f  ", timing->budgetUs / 1000.0) : printf("%12s  ", "-");
+        printf("%12.1f\n", timing->actualUs / 1000.0);
+        if (timing->budgetUs > 0 && timing->actualUs > timing->budgetUs) {
+            overBudgetCount++;
+        }
+        if (timing->actualUs > maxActualUs) {
+            maxActualUs = timing->actualUs;
+        }
+    }
+    printf("Slowest move: %.1f ms, moves over budget: %d\n\n", maxActualUs / 1000.0, overBudgetCount);
+}
+
+/*
+ * Calculate the time budget for the CPU's next move. The remaining clock is spread over the
+ * CPU's expected remaining moves and a safety margin is always kept, so the CPU never overruns its deadline.
+ */
+long long calcCpuMoveBudgetUs(long long turnAllottedUs) {
+    if (TIME_CONTROL->type == NO_TIME_CONTROL) {
+        return CPU_DEFAULT_MOVE_TIME_US;
+    }
+    long long budgetUs = turnAllottedUs;
+    if (TIME_CONTROL->type == TOTAL_PLUS_INCREMENT) {
+        // The CPU makes about half of the remaining moves, and gets the increment back after each of them
+        int movesToGo = (countBlancFields() + 1) / 2;
+        if (movesToGo > CPU_MOVES_TO_GO_HORIZON) {
+            movesToGo = CPU_MOVES_TO_GO_HORIZON;
+        } else if (movesToGo < 1) {
+            movesToGo = 1;
+        }
+        budgetUs = turnAllottedUs / movesToGo + TIME_CONTROL->incrementUs;
+    }
+    long long marginUs = turnAllottedUs / CPU_SAFETY_MARGIN_DIVISOR;
+    if (marginUs < CPU_MIN_SAFETY_MARGIN_US) {
+        marginUs = CPU_MIN_SAFETY_MARGIN_US;
+    }
+    if (budgetUs > turnAllottedUs - marginUs) {
+        budgetUs = turnAllottedUs - marginUs;
+    }
+    if (budgetUs < 0) {
+        budgetUs = 0;
+    }
+    return budgetUs;
+}
+
+/*
+ * Request the CPU's next mark by field number, using an iterative deepening search
+ * that is aborted when the time budget runs out. The best move of the deepest
+ * completed search is returned, so a legal move is always available in time.
+ */
+int requestCpuMove(char mark, long long turnStartUs, long long budgetUs) {
+    // Abort the search a little early, to cover the moves between clock checks and returning the move
+    struct cpuSearch search = { turnStartUs + budgetUs - budgetUs / CPU_SAFETY_MARGIN_DIVISOR, 0, false };
+    int candidates[MAX_ROWS * MAX_COLUMNS];
+    int candidateCount = getCandidateFields(candidates);
+    int bestFieldNbr = candidates[0];
+    if (budgetUs <= 0) {
+        return bestFieldNbr;
+    }
+    int maxDepth = countBlancFields();
+    if (maxDepth > CPU_MAX_SEARCH_DEPTH) {
+        maxDepth = CPU_MAX_SEARCH_DEPTH;
+    }
+    for (int depth = 1; depth <= maxDepth && candidateCount > 1; depth++) {
+        // Search the best move of the previous depth first, to get the most out of alpha-beta pruning
+        for (int i = 1; i < candidateCount; i++) {
+            if (candidates[i] == bestFieldNbr) {
+                candidates[i] = candidates[0];
+                candidates[0] = bestFieldNbr;
+                break;
+            }
+        }
+        int alpha = -CPU_WIN_SCORE - 1;
+        int depthBestFieldNbr = candidates[0];
+        for (int i = 0; i < candidateCount; i++) {
+            int score = scoreCpuMove(candidates[i], depth, 1, alpha, CPU_WIN_SCORE + 1, mark, &search);
+            if (search.isAborted) break;
+            if (score > alpha) {
+                alpha = score;
+                depthBestFieldNbr = candidates[i];
+            }
+        }
+        // Discard the results of an unfinished depth
+        if (search.isAborted) break;
+        bestFieldNbr = depthBestFieldNbr;
+        // Stop when the outcome is forced, or when the next depth is unlikely to finish in time
+        if (alpha >= CPU_WIN_SCORE - CPU_MAX_SEARCH_DEPTH || alpha <= -CPU_WIN_SCORE + CPU_MAX_SEARCH_DEPTH) break;
+        if (getMonotonicTimeUs() - turnStartUs > budgetUs / 2) break;
+    }
+    return bestFieldNbr;
+}
+
+/*
+ * Score a CPU search move from the perspective of the player making it,
+ * by temporarily marking the board and searching the opponent's replies
+ */
+int scoreCpuMove(int fieldNbr, int depth, int ply, int alpha, int beta, char mark, struct cpuSearch *search) {
+    // Only read the clock every few moves, since the search visits a lot of them
+    search->nodeCount++;
+    if ((search->nodeCount & CPU_CLOCK_CHECK_MASK) == 0 && getMonotonicTimeUs() >= search->deadlineUs) {
+        search->isAborted = true;
+    }
+    if (search->isAborted) {
+        return 0;
+    }
+    int rowIdx = getRowIdxForFieldNbr(fieldNbr);
+    int columnIdx = getColumnIdxForFieldNbr(fieldNbr);
+    int score;
+    BOARD[rowIdx][columnIdx] = mark;
+    if (chkWinCondition(fieldNbr, mark)) {
+        // Prefer faster wins
+        score = CPU_WIN_SCORE - ply;
+    } else if (depth <= 1) {
+        score = evaluateBoard(mark);
+    } else {
+        score = -searchCpuMoves(depth - 1, ply + 1, -beta, -alpha, mark == 'X' ? 'O' : 'X', search);
+    }
+    BOARD[rowIdx][columnIdx] = BLANC_FIELD_VALUE;
+    return score;
+}
+
+/*
+ * Negamax search with alpha-beta pruning over all candidate moves of the player with the given mark
+ */
+int searchCpuMoves(int depth, int ply, int alpha, int beta, char mark, struct cpuSearch *search) {
+    int candidates[MAX_ROWS * MAX_COLUMNS];
+    int candidateCount = getCandidateFields(candidates);
+    // A full board without a winner is a draw
+    if (candidateCount == 0) {
+        return 0;
+    }
+    int bestScore = -CPU_WIN_SCORE - 1;
+    for (int i = 0; i < candidateCount; i++) {
+        int score = scoreCpuMove(candidates[i], depth, ply, alpha, beta, mark, search);
+        if (search->isAborted) {
+            return 0;
+        }
+        if (score > bestScore) {
+            bestScore = score;
+        }
+        if (score > alpha) {
+            alpha = score;
+        }
+        if (alpha >= beta) {
+            break;
+        }
+    }
+    return bestScore;
+}
+
+/*
+ * Collect the field numbers of all blanc fields next to an already marked field.
+ * On an empty board the center field is the only candidate.
+ */
+int getCandidateFields(int *candidates) {
+    int candidateCount = 0;
+    bool hasMarks = false;
+    for (int i = 0; i < *ROWS; i++) {
+        for (int j = 0; j < *COLUMNS; j++) {
+            if (BOARD[i][j] != BLANC_FIELD_VALUE) {
+                hasMarks = true;
+                continue;
+            }
+            bool hasAdjMark = false;
+            for (int rowStep = -1; rowStep <= 1 && !hasAdjMark; rowStep++) {
+                for (int columnStep = -1; columnStep <= 1 && !hasAdjMark; columnStep++) {
+                    if (isInsideBoard(i + rowStep, j + columnStep) &&
+                        BOARD[i + rowStep][j + columnStep] != BLANC_FIELD_VALUE) {
+                        hasAdjMark = true;
+                    }
+                }
+            }
+            if (hasAdjMark) {
+                candidates[candidateCount++] = i * *COLUMNS + j + 1;
+            }
+        }
+    }
+    if (!hasMarks) {
+        candidates[candidateCount++] = ((*ROWS - 1) / 2) * *COLUMNS + (*COLUMNS - 1) / 2 + 1;
+    }
+    return candidateCount;
+}
+
+/*
+ * Evaluate the board from the perspective of the player with the given mark,
+ * by rewarding longer strings of similar marks that still have open ends
+ */
+int evaluateBoard(char mark) {
+    // Only the 4 forward directions are needed, since each string is counted from its first field
+    int directions[4][2] = { { 0, 1 }, { 1, 0 }, { 1, 1 }, { 1, -1 } };
+    int score = 0;
+    for (int i = 0; i < *ROWS; i++) {
+        for (int j = 0; j < *COLUMNS; j++) {
+            char fieldValue = BOARD[i][j];
+            if (fieldValue == BLANC_FIELD_VALUE) continue;
+            for (int d = 0; d < 4; d++) {
+                int rowStep = directions[d][0];
+                int columnStep = directions[d][1];
+                int rowIdxBefore = i - rowStep;
+                int columnIdxBefore = j - columnStep;
+                bool isInsideBefore = isInsideBoard(rowIdxBefore, columnIdxBefore);
+                if (isInsideBefore && BOARD[rowIdxBefore][columnIdxBefore] == fieldValue) continue;
+                int strLength = 1 + chkAdjMarksInDirection(i, j, rowStep, columnStep, fieldValue);
+                int rowIdxAfter = i + strLength * rowStep;
+                int columnIdxAfter = j + strLength * columnStep;
+                int openEnds = 0;
+                if (isInsideBefore && BOARD[rowIdxBefore][columnIdxBefore] == BLANC_FIELD_VALUE) {
+                    openEnds++;
+                }
+                if (isInsideBoard(rowIdxAfter, columnIdxAfter) && BOARD[rowIdxAfter][columnIdxAfter] == BLANC_FIELD_VALUE) {
+                    openEnds++;
+                }
+                int strScore = strLength * strLength * openEnds;
+                score += fieldValue == mark ? strScore : -strScore;
+            }
+        }
+    }
+    return score;
+}
+
+/*
+ * Count the number of blanc fields left on the board
+ */
+int countBlancFields(void) {
+    int blancCount = 0;
+    for (int i = 0; i < *ROWS; i++) {
+        for (int j = 0; j < *COLUMNS; j++) {
+            if (BOARD[i][j] == BLANC_FIELD_VALUE) {
+                blancCount++;
+            }
+        }
+    }
+    return blancCount;
+}
+
+/*
+ * Check whether the given indices denote a field inside the board grid
+ */
+bool isInsideBoard(int rowIdx, int columnIdx) {
+    return rowIdx >= 0 && rowIdx < *ROWS && columnIdx >= 0 && columnIdx < *COLUMNS;
+}